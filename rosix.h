@@ -72,6 +72,73 @@ typedef struct {
  */
 typedef void (*ROSIX_Callback)(ResourceHandle handle, const char* event, void* userdata);
 
+/* ============================================================================
+ * Columnar Record Batches
+ * ============================================================================ */
+
+/* Column value types */
+#define ROSIX_TYPE_BOOL        1       /* Bit-packed booleans */
+#define ROSIX_TYPE_INT32       2       /* int32_t values */
+#define ROSIX_TYPE_INT64       3       /* int64_t values */
+#define ROSIX_TYPE_DOUBLE      4       /* double values */
+#define ROSIX_TYPE_TIMESTAMP   5       /* int64_t milliseconds since the epoch */
+#define ROSIX_TYPE_STRING      6       /* UTF-8 bytes with int32_t offsets */
+
+/* Comparison operators */
+#define ROSIX_CMP_EQ           1       /* == */
+#define ROSIX_CMP_NE           2       /* != */
+#define ROSIX_CMP_LT           3       /* <  */
+#define ROSIX_CMP_LE           4       /* <= */
+#define ROSIX_CMP_GT           5       /* >  */
+#define ROSIX_CMP_GE           6       /* >= */
+
+/**
+ * Schema field descriptor
+ */
+typedef struct {
+    const char* name;                  /* Field name */
+    int type;                          /* Value type (ROSIX_TYPE_*) */
+    int nullable;                      /* Field may contain nulls */
+} ROSIX_Field;
+
+/**
+ * Record batch schema
+ */
+typedef struct {
+    const ROSIX_Field* fields;         /* Array of fields */
+    size_t field_count;                /* Number of fields */
+} ROSIX_Schema;
+
+/**
+ * Column of a record batch
+ *
+ * Fixed-width values are stored contiguously. Strings are stored as one
+ * byte buffer with row i spanning offsets[i] to offsets[i + 1]. Bit i of
+ * the validity bitmap (least significant bit first) is set when row i is
+ * not null.
+ */
+typedef struct {
+    const uint8_t* validity;           /* Validity bitmap, NULL if all rows are valid */
+    const void* values;                /* Value buffer */
+    const int32_t* offsets;            /* String offsets (row_count + 1), NULL otherwise */
+} ROSIX_Column;
+
+/**
+ * Columnar record batch
+ *
+ * When selection is set, only the listed rows (ascending row indexes) are
+ * part of the batch; filters use it to drop rows without copying columns.
+ * Every batch consumer, including processors, transforms and rule
+ * execution, must honour it.
+ */
+typedef struct {
+    const ROSIX_Schema* schema;        /* Batch schema */
+    size_t row_count;                  /* Number of rows in the columns */
+    const ROSIX_Column* columns;       /* One column per schema field */
+    const uint32_t* selection;         /* Selected row indexes, NULL for all rows */
+    size_t selected_count;             /* Number of selected rows */
+} ROSIX_RecordBatch;
+
 /* ============================================================================
  * Core Resource Operations
  * ============================================================================ */
@@ -198,6 +265,57 @@ ROSIX_Result rosix_link(ResourceHandle parent, ResourceHandle child);
  */
 ROSIX_Result rosix_unlink(ResourceHandle parent, ResourceHandle child);
 
+/* ============================================================================
+ * Timers
+ * ============================================================================ */
+
+/**
+ * Timer handle type
+ */
+typedef int ROSIX_TimerHandle;
+
+/**
+ * Callback function type for timer expiry
+ */
+typedef void (*ROSIX_TimerCallback)(ROSIX_TimerHandle timer, void* userdata);
+
+/**
+ * Create a timer
+ * 
+ * All timers in the library, including stream and task timeouts, retry
+ * backoff and rate limiter wakeups, share one hierarchical timing wheel
+ * with a 1 ms tick driven by a dedicated timer thread. Creating and
+ * cancelling a timer are O(1). Timers due in the same tick fire as one
+ * batch on the timer thread, so callbacks must not block.
+ * 
+ * @param delay_ms Delay before first expiry in milliseconds
+ * @param interval_ms Repeat interval in milliseconds, 0 for one-shot
+ * @param callback Callback function to invoke on expiry
+ * @param userdata User data passed to callback
+ * @return Timer handle on success, -1 on error
+ */
+ROSIX_TimerHandle rosix_timer_create(int delay_ms, int interval_ms,
+                                     ROSIX_TimerCallback callback, void* userdata);
+
+/**
+ * Cancel a timer
+ * 
+ * A timer cancelled before it fires never invokes its callback.
+ * 
+ * @param timer Timer handle to cancel
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_timer_cancel(ROSIX_TimerHandle timer);
+
+/**
+ * Re-arm a timer with a new delay
+ * 
+ * @param timer Timer handle to re-arm
+ * @param delay_ms New delay in milliseconds
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_timer_reset(ROSIX_TimerHandle timer, int delay_ms);
+
 /* ============================================================================
  * Utility Functions
  * ============================================================================ */
@@ -217,6 +335,16 @@ ROSIX_Result rosix_get_last_error(void);
  */
 const char* rosix_strerror(ROSIX_Result error_code);
 
+/**
+ * Get the SIMD instruction set selected at runtime
+ * 
+ * Vectorized kernels are dispatched once per process to the widest
+ * instruction set the CPU supports.
+ * 
+ * @return Instruction set name ("avx512", "avx2", "sse2", "neon" or "scalar")
+ */
+const char* rosix_get_simd_level(void);
+
 /**
  * Check if a resource handle is valid
  * 
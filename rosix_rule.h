@@ -44,6 +44,23 @@ typedef struct {
     int enabled;                      /* Rule set enabled flag */
 } ROSIX_RuleSet;
 
+/**
+ * Reference to a single rule within a rule set
+ */
+typedef struct {
+    const char* rule_set_name;        /* Rule set name, valid until the set is deleted */
+    int rule_index;                   /* Index of rule within the set */
+} ROSIX_RuleRef;
+
+/**
+ * Attribute value supplied with a rule execution context
+ */
+typedef struct {
+    int slot;                         /* Attribute slot from rosix_rule_attribute_slot */
+    double number;                    /* Numeric value */
+    const char* string;               /* String value, NULL for numeric attributes */
+} ROSIX_RuleFact;
+
 /**
  * Rule execution context
  */
@@ -53,6 +70,8 @@ typedef struct {
     void* event_data;                 /* Event data */
     time_t trigger_time;              /* Time when rule was triggered */
     char* execution_id;               /* Unique execution identifier */
+    const ROSIX_RuleFact* facts;      /* Attribute values carried by the event */
+    size_t fact_count;                /* Number of facts */
 } ROSIX_RuleContext;
 
 /**
@@ -64,6 +83,7 @@ typedef struct {
     char* action_taken;               /* Action that was taken */
     time_t execution_time;           /* Time when action was executed */
     ROSIX_Result result_code;         /* Result code */
+    size_t rules_evaluated;           /* Rules whose conditions were evaluated */
 } ROSIX_RuleResult;
 
 /* ============================================================================
@@ -73,6 +93,11 @@ typedef struct {
 /**
  * Define a new rule set
  * 
+ * Conditions and actions are parsed, type-checked and compiled once into
+ * register-based bytecode with attribute references resolved to slots.
+ * Nothing is re-parsed at execution time. On a compile error no rule set
+ * is created and the error is available from rosix_rule_get_compile_error.
+ * 
  * @param name Rule set name
  * @param rules Array of rules
  * @param count Number of rules
@@ -83,6 +108,9 @@ ROSIX_Result rosix_rule_define(const char* name, ROSIX_Rule* rules, size_t count
 /**
  * Enable a rule set
  * 
+ * The rule set's conditions are merged into the shared match network;
+ * sub-conditions already present from other enabled rule sets are reused.
+ * 
  * @param name Rule set name to enable
  * @return ROSIX_SUCCESS on success, error code on failure
  */
@@ -91,6 +119,9 @@ ROSIX_Result rosix_rule_enable(const char* name);
 /**
  * Disable a rule set
  * 
+ * The rule set's conditions are removed from the shared match network;
+ * nodes still used by other rule sets are kept.
+ * 
  * @param name Rule set name to disable
  * @return ROSIX_SUCCESS on success, error code on failure
  */
@@ -111,6 +142,32 @@ ROSIX_Result rosix_rule_delete(const char* name);
 /**
  * Execute rules for a given context
  * 
+ * Attributes are read from context->facts by slot; attributes not supplied
+ * there are read from the source resource. The facts are propagated through
+ * a Rete-style network built from all enabled rule sets: each distinct
+ * sub-condition is evaluated once per fact change and only rules whose
+ * conditions are fully matched are activated, in priority order.
+ * 
+ * When context->facts is non-empty, only rules that reference one of the
+ * supplied attributes are considered. A rule scoped to a resource (e.g.
+ * "sensor1.humidity > 80") qualifies only if that resource is the source
+ * and the scoped attribute is among the facts; unscoped rules qualify for
+ * any source. A context without facts considers the rules that reference
+ * the source resource or its attributes.
+ * 
+ * Execution is level-triggered for every rule: each execution activates
+ * all dependent rules whose condition holds for the supplied facts. Rules
+ * whose condition is a single "attribute <op> constant" comparison with
+ * <op> one of <, <=, > or >= are kept in sorted threshold arrays instead
+ * of the network, one per comparison direction and per (resource,
+ * attribute) for resource-scoped rules or per attribute for unscoped
+ * rules. A binary search on the fact value in the source's arrays and the
+ * unscoped arrays yields the satisfied rules as contiguous ranges, without
+ * evaluating each rule. Equality comparisons stay in the network.
+ * Use rosix_rule_evaluate_transitions for edge-triggered behaviour;
+ * execution neither stores the context's facts nor changes the previous
+ * values that function compares against.
+ * 
  * @param context Rule execution context
  * @param result Output parameter for execution result
  * @return ROSIX_SUCCESS on success, error code on failure
@@ -132,6 +189,82 @@ ROSIX_Result rosix_rule_execute_specific(const char* rule_set_name,
                                          const ROSIX_RuleContext* context,
                                          ROSIX_RuleResult* result);
 
+/**
+ * Execute rules for a batch of contexts
+ * 
+ * Facts are transposed into one column per attribute slot and compiled
+ * conditions are evaluated column-wise with SIMD comparisons (see
+ * rosix_get_simd_level), narrowing a selection vector per condition.
+ * 
+ * As in rosix_rule_execute, each context is evaluated on its own facts:
+ * attributes missing from a context are read from its source resource,
+ * and no state is carried between contexts or into the previous values
+ * used by rosix_rule_evaluate_transitions. Actions then run for the
+ * selected rows in context order, so results match calling
+ * rosix_rule_execute on each context in turn, except that attribute
+ * values are read once at the start of the batch and changes made by
+ * actions become visible only after it.
+ * 
+ * @param contexts Array of rule execution contexts
+ * @param count Number of contexts
+ * @param results Array to store one execution result per context
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_rule_execute_batch(const ROSIX_RuleContext contexts[],
+                                      size_t count,
+                                      ROSIX_RuleResult results[]);
+
+/**
+ * Execute rules over a columnar record batch
+ * 
+ * Each row is one event; columns are matched to attributes by field name.
+ * Avoids building per-row contexts for events taken from typed streams.
+ * Rows are processed as in rosix_rule_execute_batch. Rows outside the
+ * batch's selection vector are skipped and their results left unchanged.
+ * 
+ * @param batch Record batch of events
+ * @param sources Source resource per row (row_count entries), or NULL to
+ *        read handles from a ROSIX_TYPE_INT32 column named "source"
+ * @param event_type Event type for all rows
+ * @param results Array to store one execution result per row
+ * @return ROSIX_SUCCESS on success, ROSIX_INVALID_PARAM if sources is NULL
+ *         and the batch has no "source" column
+ */
+ROSIX_Result rosix_rule_execute_record_batch(const ROSIX_RecordBatch* batch,
+                                             const ResourceHandle* sources,
+                                             const char* event_type,
+                                             ROSIX_RuleResult results[]);
+
+/**
+ * Rule condition transition
+ */
+typedef struct {
+    ROSIX_RuleRef rule;               /* Rule whose condition changed */
+    int satisfied;                    /* Non-zero if newly satisfied, zero if cleared */
+} ROSIX_RuleTransition;
+
+/**
+ * Find rules whose conditions changed truth value for a context
+ * 
+ * Applies the facts in the context and reports the resulting transitions
+ * without executing any action. The previous value of each attribute is
+ * kept per (context->source, slot), so facts from different resources
+ * never compare against each other. Only unscoped rules and rules scoped
+ * to the source are reported. For threshold-indexed rules, a binary
+ * search on the old and new value and a walk over the thresholds between
+ * them find exactly the rules that changed. The first value seen for a
+ * (source, slot) pair reports every rule it satisfies as newly satisfied
+ * and clears nothing.
+ * 
+ * @param context Rule execution context
+ * @param transitions Array to store transitions
+ * @param max_transitions Maximum number of transitions to return
+ * @return Number of transitions found on success, -1 on error
+ */
+int rosix_rule_evaluate_transitions(const ROSIX_RuleContext* context,
+                                    ROSIX_RuleTransition* transitions,
+                                    size_t max_transitions);
+
 /* ============================================================================
  * Rule Monitoring and Statistics
  * ============================================================================ */
@@ -150,6 +283,58 @@ ROSIX_Result rosix_rule_get_stats(const char* rule_set_name,
                                   uint64_t* successful_executions,
                                   uint64_t* failed_executions);
 
+/**
+ * Shared match network statistics structure
+ */
+typedef struct {
+    size_t rules;                     /* Rules in the network */
+    size_t condition_nodes;           /* Distinct single-attribute condition nodes */
+    size_t join_nodes;                /* Nodes combining conditions */
+    size_t shared_nodes;              /* Nodes used by more than one rule */
+    uint64_t fact_changes;            /* Fact changes propagated */
+    uint64_t node_evaluations;        /* Condition node evaluations */
+    uint64_t activations;             /* Rule activations */
+    size_t threshold_indexes;         /* Threshold arrays ((resource, attribute) or attribute) */
+    size_t threshold_rules;           /* Rules served by threshold indexes */
+} ROSIX_RuleNetworkStats;
+
+/**
+ * Get the attributes and resources a rule references
+ * 
+ * Reference sets are collected when the rule is compiled and drive the
+ * dependency index used by rosix_rule_execute.
+ * 
+ * @param rule_set_name Rule set name
+ * @param rule_index Index of rule
+ * @param references Output array for attribute names and resource URIs
+ * @param max_references Maximum number of references to return
+ * @return Number of references found on success, -1 on error
+ */
+int rosix_rule_get_references(const char* rule_set_name,
+                              int rule_index,
+                              char** references,
+                              size_t max_references);
+
+/**
+ * Find the rules that reference an attribute or resource
+ * 
+ * @param reference Attribute name or resource URI
+ * @param rules Array to store references to the matching rules
+ * @param max_rules Maximum number of rules to return
+ * @return Number of rules found on success, -1 on error
+ */
+int rosix_rule_find_referencing(const char* reference,
+                                ROSIX_RuleRef* rules,
+                                size_t max_rules);
+
+/**
+ * Get shared match network statistics
+ * 
+ * @param stats Output parameter for network statistics
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_rule_get_network_stats(ROSIX_RuleNetworkStats* stats);
+
 /**
  * Get rule execution history
  * 
@@ -178,6 +363,18 @@ int rosix_rule_get_history(const char* rule_set_name,
  */
 ROSIX_Result rosix_rule_validate_condition(const char* condition);
 
+/**
+ * Get the last rule compile error of the calling thread
+ * 
+ * @param rule_index Output parameter for index of the failing rule
+ * @param offset Output parameter for character offset in the expression
+ * @param message Buffer to store the error message
+ * @param len Maximum length of message buffer
+ * @return ROSIX_SUCCESS if an error was recorded, ROSIX_NOT_FOUND otherwise
+ */
+ROSIX_Result rosix_rule_get_compile_error(int* rule_index, size_t* offset,
+                                          char* message, size_t len);
+
 /**
  * Validate a rule action
  * 
@@ -232,6 +429,8 @@ ROSIX_Result rosix_rule_export_json(const char* rule_set_name, char** json_outpu
 /**
  * Import rule set from JSON
  * 
+ * Rules are compiled as in rosix_rule_define.
+ * 
  * @param json_input JSON string to import
  * @param rule_set_name Output parameter for rule set name
  * @return ROSIX_SUCCESS on success, error code on failure
@@ -282,6 +481,17 @@ int rosix_rule_get_dependencies(const char* rule_set_name,
  * Utility Functions
  * ============================================================================ */
 
+/**
+ * Get the slot of an attribute name
+ * 
+ * Slots are stable for the lifetime of the process and are shared by all
+ * rule sets.
+ * 
+ * @param attribute Attribute name (e.g., "temperature")
+ * @return Slot number on success, -1 on error
+ */
+int rosix_rule_attribute_slot(const char* attribute);
+
 /**
  * List all available rule sets
  * 
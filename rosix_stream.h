@@ -22,11 +22,72 @@ extern "C" {
  * Stream Data Structures
  * ============================================================================ */
 
+/* Message priority classes (higher number = higher priority) */
+#define ROSIX_PRIORITY_LOW      0      /* Bulk or diagnostic telemetry */
+#define ROSIX_PRIORITY_NORMAL   1      /* Regular telemetry */
+#define ROSIX_PRIORITY_HIGH     2      /* Events and state changes */
+#define ROSIX_PRIORITY_CRITICAL 3      /* Alarms, never shed */
+#define ROSIX_PRIORITY_CLASSES  4      /* Number of priority classes */
+
 /**
  * Stream processing function type
  */
 typedef void (*ROSIX_StreamProcessor)(const void* data, size_t size, void* context);
 
+/**
+ * Record batch processing function type
+ *
+ * The batch and its buffers are valid only for the duration of the call.
+ */
+typedef void (*ROSIX_BatchProcessor)(const ROSIX_RecordBatch* batch, void* context);
+
+/**
+ * Record batch transformation function type
+ *
+ * output starts as a copy of input. A filter narrows output->selection; a
+ * transformation may replace output->schema and output->columns. Buffers
+ * referenced by output must be owned by the transformation and stay valid
+ * until it is called again or the stream is closed. The output schema must
+ * be the same for every batch.
+ */
+typedef ROSIX_Result (*ROSIX_BatchTransform)(const ROSIX_RecordBatch* input,
+                                             ROSIX_RecordBatch* output,
+                                             void* context);
+
+/**
+ * Message key extractor function type
+ *
+ * Writes a NUL-terminated key (item, partition, resource URI, ...) for the
+ * message into key. Returns the key length, or -1 if the message has no key.
+ */
+typedef int (*ROSIX_StreamKeyExtractor)(const void* data, size_t size,
+                                        char* key, size_t key_len,
+                                        void* context);
+
+/**
+ * Message value extractor function type
+ *
+ * Stores the numeric value carried by the message into value.
+ */
+typedef ROSIX_Result (*ROSIX_StreamValueExtractor)(const void* data, size_t size,
+                                                   double* value, void* context);
+
+/**
+ * Message priority extractor function type
+ *
+ * Returns the priority class (ROSIX_PRIORITY_*) of the message.
+ */
+typedef int (*ROSIX_StreamPriorityExtractor)(const void* data, size_t size,
+                                             void* context);
+
+/**
+ * Message event-time extractor function type
+ *
+ * Returns the event timestamp of the message in milliseconds since the epoch.
+ */
+typedef int64_t (*ROSIX_StreamTimestampExtractor)(const void* data, size_t size,
+                                                  void* context);
+
 /**
  * Stream configuration structure
  */
@@ -37,8 +98,29 @@ typedef struct {
     size_t buffer_size;                /* Stream buffer size */
     int max_retries;                   /* Maximum retry attempts */
     int timeout_ms;                    /* Timeout in milliseconds */
+    const ROSIX_Schema* schema;        /* Payload schema, NULL for opaque bytes */
+    ROSIX_BatchProcessor process_batch; /* Batch processing function for typed payloads */
 } ROSIX_Stream;
 
+/**
+ * Stream consumer cursor type
+ */
+typedef int ROSIX_StreamCursor;
+
+/**
+ * Latency distribution summary
+ *
+ * Values are read from log-bucketed histograms with about 1% relative error.
+ */
+typedef struct {
+    uint64_t count;                    /* Number of samples recorded */
+    double p50;                        /* Median in ms */
+    double p90;                        /* 90th percentile in ms */
+    double p99;                        /* 99th percentile in ms */
+    double p999;                       /* 99.9th percentile in ms */
+    double max;                        /* Maximum in ms */
+} ROSIX_LatencySummary;
+
 /**
  * Stream statistics structure
  */
@@ -46,10 +128,34 @@ typedef struct {
     uint64_t bytes_processed;          /* Total bytes processed */
     uint64_t messages_processed;       /* Total messages processed */
     uint64_t errors;                   /* Total errors encountered */
+    uint64_t duplicates_dropped;       /* Messages dropped by deduplication */
+    uint64_t dedup_overflows;          /* Dedup generations retired early by excess rate */
+    uint64_t late_messages;            /* Messages behind the watermark on arrival */
+    uint64_t bytes_spilled;            /* Total bytes written to overflow segments */
+    uint64_t spill_backlog;            /* Bytes currently waiting on disk */
+    uint64_t overflow_messages_dropped; /* Messages dropped at the spill limit */
+    uint64_t overflow_bytes_dropped;   /* Bytes dropped at the spill limit */
+    uint64_t retries;                  /* Retry attempts scheduled */
+    uint64_t dead_letters;             /* Messages moved to the dead-letter queue */
+    uint64_t messages_shed[ROSIX_PRIORITY_CLASSES]; /* Messages shed per priority class */
+    uint64_t bytes_shed[ROSIX_PRIORITY_CLASSES];    /* Bytes shed per priority class */
     double avg_processing_time;        /* Average processing time in ms */
     double throughput;                 /* Throughput in bytes/second */
+    ROSIX_LatencySummary processing_time; /* Time spent in operators per message */
+    ROSIX_LatencySummary queue_wait;   /* Time spent buffered before processing */
+    ROSIX_LatencySummary end_to_end;   /* Event time (or arrival) to processing done */
 } ROSIX_StreamStats;
 
+/**
+ * Stream operator statistics structure
+ */
+typedef struct {
+    const char* kind;                  /* Operator kind ("filter", "transform", "sketch", ...) */
+    uint64_t messages_in;              /* Messages received by the operator */
+    uint64_t messages_out;             /* Messages emitted by the operator */
+    ROSIX_LatencySummary processing_time; /* Time spent in the operator per message */
+} ROSIX_StreamOperatorStats;
+
 /* ============================================================================
  * Stream Operations
  * ============================================================================ */
@@ -57,12 +163,43 @@ typedef struct {
 /**
  * Open a stream from a resource source
  * 
+ * If stream->schema is set, it is checked once against the schema the
+ * source produces and payloads are delivered as ROSIX_RecordBatch values
+ * to process_batch; otherwise process receives opaque bytes.
+ * 
+ * On a typed stream, byte-oriented hooks (process, filters, transforms,
+ * consumers and message extractors) are called once per selected row,
+ * with data pointing to a ROSIX_RecordBatch holding only that row and
+ * size set to sizeof(ROSIX_RecordBatch).
+ * 
  * @param source Source resource handle
  * @param stream Stream configuration structure
  * @return ROSIX_SUCCESS on success, error code on failure
  */
 ROSIX_Result rosix_stream_open(ResourceHandle source, ROSIX_Stream* stream);
 
+/**
+ * Get the payload schema of a stream
+ * 
+ * @param stream Stream to query
+ * @param schema Output parameter for schema, valid until the stream is closed
+ * @return ROSIX_SUCCESS on success, ROSIX_NOT_FOUND for opaque streams
+ */
+ROSIX_Result rosix_stream_get_schema(ROSIX_Stream* stream, const ROSIX_Schema** schema);
+
+/**
+ * Write a record batch to a typed stream
+ * 
+ * The selected rows are copied into the stream before the call returns, so
+ * the caller may reuse its buffers immediately.
+ * 
+ * @param stream Stream to write to
+ * @param batch Record batch matching the stream schema
+ * @return ROSIX_SUCCESS on success, ROSIX_INVALID_PARAM on schema mismatch
+ */
+ROSIX_Result rosix_stream_write_batch(ROSIX_Stream* stream,
+                                      const ROSIX_RecordBatch* batch);
+
 /**
  * Subscribe to stream events
  * 
@@ -80,6 +217,44 @@ ROSIX_Result rosix_stream_subscribe(ROSIX_Stream* stream, ROSIX_Callback callbac
  */
 ROSIX_Result rosix_stream_unsubscribe(ROSIX_Stream* stream);
 
+/**
+ * Attach a data consumer to the stream
+ * 
+ * All consumers read from one shared ring through their own sequence
+ * cursor; each message is written once regardless of the consumer count.
+ * A ring slot is reused only after the slowest cursor has passed it, so a
+ * lagging consumer applies backpressure (or spill, if enabled). The data
+ * pointer passed to process is valid only for the duration of the call.
+ * 
+ * @param stream Stream to consume
+ * @param process Consumer processing function
+ * @param context User context for processing
+ * @return Consumer cursor on success, -1 on error
+ */
+ROSIX_StreamCursor rosix_stream_add_consumer(ROSIX_Stream* stream,
+                                             ROSIX_StreamProcessor process,
+                                             void* context);
+
+/**
+ * Detach a data consumer from the stream
+ * 
+ * @param stream Stream being consumed
+ * @param cursor Consumer cursor to remove
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_remove_consumer(ROSIX_Stream* stream,
+                                          ROSIX_StreamCursor cursor);
+
+/**
+ * Get the lag of a data consumer
+ * 
+ * @param stream Stream being consumed
+ * @param cursor Consumer cursor
+ * @return Number of messages behind the producer, -1 on error
+ */
+int64_t rosix_stream_get_consumer_lag(ROSIX_Stream* stream,
+                                      ROSIX_StreamCursor cursor);
+
 /**
  * Close a stream and release resources
  * 
@@ -95,6 +270,10 @@ ROSIX_Result rosix_stream_close(ROSIX_Stream* stream);
 /**
  * Start stream processing
  * 
+ * The stream runs on its owning runtime worker (see
+ * rosix_stream_set_worker). The runtime is initialized with default
+ * settings on first use if rosix_stream_runtime_init was not called.
+ * 
  * @param stream Stream to start
  * @return ROSIX_SUCCESS on success, error code on failure
  */
@@ -111,6 +290,10 @@ ROSIX_Result rosix_stream_stop(ROSIX_Stream* stream);
 /**
  * Pause stream processing
  * 
+ * The source keeps filling the in-memory buffer. Once it is full, data is
+ * spilled to disk if enabled (see rosix_stream_enable_spill), otherwise
+ * the source is blocked.
+ * 
  * @param stream Stream to pause
  * @return ROSIX_SUCCESS on success, error code on failure
  */
@@ -119,11 +302,303 @@ ROSIX_Result rosix_stream_pause(ROSIX_Stream* stream);
 /**
  * Resume stream processing
  * 
+ * Messages are delivered in arrival order: the in-memory ring first, then
+ * the spill segments oldest first, then newer messages.
+ * 
  * @param stream Stream to resume
  * @return ROSIX_SUCCESS on success, error code on failure
  */
 ROSIX_Result rosix_stream_resume(ROSIX_Stream* stream);
 
+/* ============================================================================
+ * Stream Buffering
+ * ============================================================================ */
+
+/* Overflow policies when the spill limit is reached */
+#define ROSIX_STREAM_OVERFLOW_BLOCK       0   /* Block the source */
+#define ROSIX_STREAM_OVERFLOW_DROP_NEWEST 1   /* Drop incoming messages */
+#define ROSIX_STREAM_OVERFLOW_DROP_OLDEST 2   /* Drop the oldest spilled segment */
+
+/**
+ * Stream spill configuration structure
+ *
+ * Messages stay in the in-memory ring while it has room. When the ring
+ * fills during a pause or slow consumption, new messages are appended to
+ * sequential overflow segments; no disk I/O happens otherwise. While the
+ * spill backlog is non-zero, new messages keep going to the spill even if
+ * the ring has room, and the ring is refilled from the oldest segment, so
+ * arrival order is preserved.
+ */
+typedef struct {
+    const char* spill_path;            /* Directory for overflow segments */
+    size_t segment_size;               /* Bytes per overflow segment */
+    uint64_t max_spill_bytes;          /* Disk limit, 0 for unlimited */
+    int overflow_policy;               /* Policy at the limit (ROSIX_STREAM_OVERFLOW_*) */
+} ROSIX_StreamSpillConfig;
+
+/**
+ * Enable spilling of buffer overflow to disk
+ * 
+ * @param stream Stream to configure
+ * @param config Spill configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_enable_spill(ROSIX_Stream* stream,
+                                       const ROSIX_StreamSpillConfig* config);
+
+/**
+ * Disable spilling of buffer overflow to disk
+ * 
+ * Data already spilled is still drained, in order, before newer data.
+ * 
+ * @param stream Stream to configure
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_disable_spill(ROSIX_Stream* stream);
+
+/**
+ * Load shedding configuration structure
+ *
+ * Between shed_start_usage and shed_full_usage buffer occupancy, messages
+ * of the lowest sheddable class are sampled with a drop probability rising
+ * linearly to 1; higher classes start shedding only once all lower classes
+ * are fully dropped. Exceeding latency_target_ms raises the drop level the
+ * same way. ROSIX_PRIORITY_CRITICAL messages are never shed.
+ */
+typedef struct {
+    ROSIX_StreamPriorityExtractor priority; /* Priority extractor */
+    void* extractor_context;           /* User context for extractor */
+    int shed_start_usage;              /* Buffer usage percentage where shedding starts */
+    int shed_full_usage;               /* Buffer usage percentage where shedding is total */
+    double latency_target_ms;          /* Queue wait p99 that triggers shedding, 0 to ignore */
+    int max_shed_class;                /* Highest class that may be shed */
+} ROSIX_StreamSheddingConfig;
+
+/**
+ * Enable priority-aware load shedding
+ * 
+ * Shed messages are counted per class in ROSIX_StreamStats.
+ * 
+ * @param stream Stream to configure
+ * @param config Load shedding configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_enable_shedding(ROSIX_Stream* stream,
+                                          const ROSIX_StreamSheddingConfig* config);
+
+/**
+ * Disable load shedding
+ * 
+ * @param stream Stream to configure
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_disable_shedding(ROSIX_Stream* stream);
+
+/* ============================================================================
+ * Stream Error Handling
+ * ============================================================================ */
+
+/**
+ * Stream retry policy structure
+ *
+ * The delay before retry n is initial_backoff_ms * multiplier^(n-1),
+ * capped at max_backoff_ms and randomized by +/- jitter.
+ */
+typedef struct {
+    int initial_backoff_ms;            /* Delay before the first retry */
+    int max_backoff_ms;                /* Upper bound on retry delay */
+    double multiplier;                 /* Backoff growth factor */
+    double jitter;                     /* Random fraction applied to each delay (0.0 to 1.0) */
+} ROSIX_StreamRetryPolicy;
+
+/**
+ * Dead-letter entry structure
+ */
+typedef struct {
+    void* data;                        /* Copy of the failed message */
+    size_t size;                       /* Message size in bytes */
+    ROSIX_Result error_code;           /* Error reported by the last attempt */
+    int attempts;                      /* Processing attempts made, including the first */
+    time_t first_failure;              /* Time of the first failure */
+    time_t last_failure;               /* Time of the last failure */
+} ROSIX_DeadLetter;
+
+/**
+ * Mark the message being processed as failed
+ * 
+ * Called from a stream processor. The message is scheduled for retry on
+ * the shared timer wheel (see rosix_timer_create) and the stream
+ * continues with the next message, so retried messages may be delivered
+ * out of order. After max_retries retries (max_retries + 1 attempts in
+ * total) the message is moved to the stream's dead-letter queue.
+ * 
+ * On a typed stream, a call from a per-row hook fails that row, and a call
+ * from a batch callback fails every selected row of the batch. Each failed
+ * row is retried and dead-lettered on its own as a single-row
+ * ROSIX_RecordBatch.
+ * 
+ * @param stream Stream processing the message
+ * @param error_code Error to record for the message
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_fail_message(ROSIX_Stream* stream, ROSIX_Result error_code);
+
+/**
+ * Set stream retry policy
+ * 
+ * @param stream Stream to configure
+ * @param policy Retry policy
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_retry_policy(ROSIX_Stream* stream,
+                                           const ROSIX_StreamRetryPolicy* policy);
+
+/**
+ * Set dead-letter queue capacity
+ * 
+ * When the queue is full the oldest entry is discarded.
+ * 
+ * @param stream Stream to configure
+ * @param capacity Maximum number of dead letters kept
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_dead_letter_capacity(ROSIX_Stream* stream,
+                                                   size_t capacity);
+
+/**
+ * Read and remove entries from the dead-letter queue
+ * 
+ * @param stream Stream owning the queue
+ * @param letters Array to store dead letters, oldest first
+ * @param max_letters Maximum number of dead letters to return
+ * @return Number of dead letters returned on success, -1 on error
+ */
+int rosix_stream_read_dead_letters(ROSIX_Stream* stream,
+                                   ROSIX_DeadLetter* letters,
+                                   size_t max_letters);
+
+/**
+ * Requeue all dead letters for processing
+ * 
+ * Each message gets a fresh retry budget.
+ * 
+ * @param stream Stream owning the queue
+ * @return Number of messages requeued on success, -1 on error
+ */
+int rosix_stream_replay_dead_letters(ROSIX_Stream* stream);
+
+/**
+ * Free memory allocated for dead-letter entries
+ * 
+ * @param letters Dead letters to free
+ * @param count Number of entries
+ */
+void rosix_stream_free_dead_letters(ROSIX_DeadLetter* letters, size_t count);
+
+/* ============================================================================
+ * Stream Runtime
+ * ============================================================================ */
+
+/* Runtime scheduling modes */
+#define ROSIX_STREAM_SCHED_PINNED        0   /* Streams stay on their owning worker */
+#define ROSIX_STREAM_SCHED_WORK_STEALING 1   /* Idle workers steal runnable streams */
+
+/**
+ * Stream runtime configuration structure
+ *
+ * The runtime pins one worker thread per CPU. Each stream and its operators
+ * run only on the owning worker; data crossing workers (aggregate, split)
+ * moves through single-producer single-consumer queues.
+ *
+ * With work stealing, each worker keeps a deque of runnable streams, each
+ * entry standing for all pending batches of one stream. A stream appears
+ * at most once across all deques and is removed while a worker runs it.
+ * Idle workers steal whole streams from the cold end of a busy worker's
+ * deque, so a stream's batches always move together and never run
+ * concurrently, and messages of a stream are processed in order.
+ */
+typedef struct {
+    const int* cpus;                   /* CPUs to pin workers to, NULL for all online CPUs */
+    size_t cpu_count;                  /* Number of entries in cpus */
+    int numa_local;                    /* Allocate buffers on the worker's NUMA node */
+    size_t queue_capacity;             /* Capacity of each cross-worker SPSC queue */
+    int scheduling;                    /* Scheduling mode (ROSIX_STREAM_SCHED_*) */
+    size_t steal_count;                /* Maximum runnable streams taken per steal */
+} ROSIX_StreamRuntimeConfig;
+
+/**
+ * Stream runtime worker statistics structure
+ */
+typedef struct {
+    int cpu;                           /* CPU the worker is pinned to */
+    int numa_node;                     /* NUMA node of the worker */
+    size_t streams;                    /* Streams owned by the worker */
+    uint64_t messages_processed;       /* Messages processed by the worker */
+    uint64_t remote_messages;          /* Messages received from other workers */
+    uint64_t busy_ns;                  /* Time spent running operators */
+    uint64_t idle_ns;                  /* Time spent waiting for work */
+    uint64_t steals;                   /* Successful steals by this worker */
+    uint64_t steal_attempts;           /* Steal attempts by this worker */
+    uint64_t streams_stolen;           /* Streams taken from this worker by others */
+} ROSIX_StreamWorkerStats;
+
+/**
+ * Initialize the stream runtime
+ * 
+ * @param config Runtime configuration, NULL for defaults
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_runtime_init(const ROSIX_StreamRuntimeConfig* config);
+
+/**
+ * Shut down the stream runtime
+ * 
+ * Stops all streams and joins the worker threads.
+ * 
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_runtime_shutdown(void);
+
+/**
+ * Get the number of runtime workers
+ * 
+ * @return Number of workers on success, -1 on error
+ */
+int rosix_stream_runtime_get_worker_count(void);
+
+/**
+ * Get runtime worker statistics
+ * 
+ * @param worker Worker index
+ * @param stats Output parameter for worker statistics
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_runtime_get_worker_stats(int worker,
+                                                   ROSIX_StreamWorkerStats* stats);
+
+/**
+ * Assign a stream to a runtime worker
+ * 
+ * Must be called before rosix_stream_start. Unassigned streams are placed
+ * on the worker local to their source, or round-robin otherwise. With work
+ * stealing this is the stream's home worker, which it returns to when idle.
+ * 
+ * @param stream Stream to assign
+ * @param worker Worker index
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_worker(ROSIX_Stream* stream, int worker);
+
+/**
+ * Get the runtime worker owning a stream
+ * 
+ * With work stealing the owner can change whenever the stream is not running.
+ * 
+ * @param stream Stream to check
+ * @return Worker index on success, -1 on error
+ */
+int rosix_stream_get_worker(ROSIX_Stream* stream);
+
 /* ============================================================================
  * Stream Filtering and Transformation
  * ============================================================================ */
@@ -152,15 +627,215 @@ ROSIX_Result rosix_stream_add_transform(ROSIX_Stream* stream,
                                         ROSIX_StreamProcessor transform_function,
                                         void* transform_context);
 
+/**
+ * Stream deduplication configuration structure
+ *
+ * Message IDs are kept in a cuckoo filter split into generations covering
+ * window_ms; the oldest generation is discarded as time advances, so
+ * memory depends only on expected_rate, window_ms and false_positive_rate.
+ * The last exact_recent IDs are also kept in an exact set. A message whose
+ * ID hits the filter is:
+ *   - dropped if its ID is in the exact set;
+ *   - passed if its ID is not in the exact set and the matching filter
+ *     entry is younger than the oldest ID in the exact set (the hit is
+ *     then certainly a false positive);
+ *   - dropped otherwise, wrongly with probability at most
+ *     false_positive_rate.
+ *
+ * If the actual rate exceeds expected_rate, a generation that fills up is
+ * retired early instead of growing or overfilling the filter. Memory and
+ * the false_positive_rate bound are kept, but IDs are then remembered for
+ * less than window_ms, so older duplicates can pass. Each early retirement
+ * is counted in ROSIX_StreamStats.dedup_overflows.
+ */
+typedef struct {
+    ROSIX_StreamKeyExtractor message_id; /* Message ID extractor */
+    void* extractor_context;           /* User context for extractor */
+    int window_ms;                     /* Time a message ID is remembered */
+    size_t expected_rate;              /* Expected messages per second */
+    double false_positive_rate;        /* Bound on dropping a unique message */
+    size_t exact_recent;               /* IDs kept in the exact recent set */
+} ROSIX_StreamDedupConfig;
+
+/**
+ * Add a deduplication operator to the stream
+ * 
+ * Drops messages whose ID was already seen within the window, such as
+ * redeliveries caused by retries. Messages without an ID are passed on.
+ * 
+ * @param stream Stream to deduplicate
+ * @param config Deduplication configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_add_dedup(ROSIX_Stream* stream,
+                                    const ROSIX_StreamDedupConfig* config);
+
+/**
+ * Add a record batch transformation to a typed stream
+ * 
+ * A transformation returning an error fails the batch as if
+ * rosix_stream_fail_message had been called with that error.
+ * 
+ * @param stream Stream to add transformation to
+ * @param transform_function Batch transformation function
+ * @param transform_context Context for transformation function
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_add_batch_transform(ROSIX_Stream* stream,
+                                              ROSIX_BatchTransform transform_function,
+                                              void* transform_context);
+
+/* Built-in numeric operators */
+#define ROSIX_NUMERIC_THRESHOLD      1   /* Keep rows where value cmp a */
+#define ROSIX_NUMERIC_SCALE          2   /* value * a + b */
+#define ROSIX_NUMERIC_DEADBAND       3   /* Drop rows within a of the last kept value */
+#define ROSIX_NUMERIC_CLAMP          4   /* Clamp value to [a, b] */
+#define ROSIX_NUMERIC_MOVING_AVERAGE 5   /* Mean of the last window values */
+#define ROSIX_NUMERIC_FIR            6   /* FIR filter with taps */
+
+/**
+ * Built-in numeric operator descriptor
+ */
+typedef struct {
+    int op;                            /* Operator (ROSIX_NUMERIC_*) */
+    const char* column;                /* ROSIX_TYPE_DOUBLE column to operate on */
+    int cmp;                           /* Comparison for thresholds (ROSIX_CMP_*) */
+    double a;                          /* First operand */
+    double b;                          /* Second operand */
+    size_t window;                     /* Moving average window in rows */
+    const double* taps;                /* FIR coefficients */
+    size_t tap_count;                  /* Number of FIR coefficients */
+} ROSIX_NumericOp;
+
+/**
+ * Add a chain of built-in numeric operators to a typed stream
+ * 
+ * The chain runs over whole record batches with SIMD kernels selected at
+ * runtime (see rosix_get_simd_level). Stages are fused and applied block
+ * by block so each batch is read from memory once; thresholds and
+ * deadbands narrow the batch's selection vector (see ROSIX_RecordBatch)
+ * instead of copying rows, and later stages only visit selected rows.
+ * Stateful operators carry their state across batches of the stream.
+ * 
+ * @param stream Typed stream to add operators to
+ * @param ops Array of operators, applied in order
+ * @param num_ops Number of operators
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_add_numeric_chain(ROSIX_Stream* stream,
+                                            const ROSIX_NumericOp* ops,
+                                            size_t num_ops);
+
 /**
  * Set stream processing rate limit
  * 
+ * Equivalent to a private token bucket with rate max_rate and a burst of
+ * one second's worth of messages.
+ * 
  * @param stream Stream to limit
  * @param max_rate Maximum processing rate (messages per second)
  * @return ROSIX_SUCCESS on success, error code on failure
  */
 ROSIX_Result rosix_stream_set_rate_limit(ROSIX_Stream* stream, int max_rate);
 
+/**
+ * Rate budget handle type
+ */
+typedef int ROSIX_RateBudget;
+
+/**
+ * Create a token-bucket rate budget
+ * 
+ * A message consumes one token from the stream's budget and from every
+ * parent budget up to the root, so related streams can share a common
+ * limit (e.g. the uplink of a substation). The take is all-or-nothing:
+ * if any budget on the path is empty, tokens already taken from budgets
+ * below it are refunded and the message is throttled. Buckets are refilled lazily
+ * from a monotonic cycle counter and updated with atomic operations, so
+ * no lock or system call is taken per message. Throttled streams are
+ * woken by the shared timer wheel.
+ * 
+ * @param rate Refill rate in messages per second
+ * @param burst Bucket capacity in messages
+ * @param parent Parent budget, -1 for none
+ * @return Budget handle on success, -1 on error
+ */
+ROSIX_RateBudget rosix_rate_budget_create(double rate, double burst,
+                                          ROSIX_RateBudget parent);
+
+/**
+ * Destroy a rate budget
+ * 
+ * @param budget Budget to destroy, must have no children or streams attached
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_rate_budget_destroy(ROSIX_RateBudget budget);
+
+/**
+ * Change the rate and burst of a budget
+ * 
+ * @param budget Budget to update
+ * @param rate Refill rate in messages per second
+ * @param burst Bucket capacity in messages
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_rate_budget_update(ROSIX_RateBudget budget, double rate,
+                                      double burst);
+
+/**
+ * Attach a stream to a rate budget
+ * 
+ * Replaces any limit set with rosix_stream_set_rate_limit.
+ * 
+ * @param stream Stream to limit
+ * @param budget Budget to draw from, -1 to remove the limit
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_rate_budget(ROSIX_Stream* stream,
+                                          ROSIX_RateBudget budget);
+
+/* ============================================================================
+ * Stream Sinks
+ * ============================================================================ */
+
+/**
+ * ResourceSpace sink configuration structure
+ *
+ * Within each flush interval only the latest value and state per resource
+ * are kept. A flush applies them to ResourceSpace as one columnar update
+ * and appends the buffered samples to temporal history in bulk.
+ */
+typedef struct {
+    ROSIX_StreamKeyExtractor resource; /* Target resource URI extractor */
+    ROSIX_StreamValueExtractor value;  /* Latest value extractor, NULL for state only */
+    ROSIX_StreamKeyExtractor state;    /* State extractor, NULL for value only */
+    void* extractor_context;           /* User context for extractors */
+    const char* value_attribute;       /* Attribute the latest value is stored under */
+    int flush_interval_ms;             /* Maximum age of data seen by rosix_resolve */
+    int record_history;                /* Append every sample to temporal history */
+} ROSIX_StreamSinkConfig;
+
+/**
+ * Add a ResourceSpace sink to the stream
+ * 
+ * Replaces per-message rosix_update_temporal calls. Pending updates are
+ * flushed by rosix_stream_stop and rosix_stream_close.
+ * 
+ * @param stream Stream to add sink to
+ * @param config Sink configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_add_resource_sink(ROSIX_Stream* stream,
+                                            const ROSIX_StreamSinkConfig* config);
+
+/**
+ * Flush pending sink updates to ResourceSpace immediately
+ * 
+ * @param stream Stream to flush
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_flush_sinks(ROSIX_Stream* stream);
+
 /* ============================================================================
  * Stream Monitoring and Statistics
  * ============================================================================ */
@@ -168,6 +843,9 @@ ROSIX_Result rosix_stream_set_rate_limit(ROSIX_Stream* stream, int max_rate);
 /**
  * Get stream statistics
  * 
+ * Latency histograms are recorded per worker thread without locks and
+ * merged when this function is called.
+ * 
  * @param stream Stream to get statistics for
  * @param stats Output parameter for statistics
  * @return ROSIX_SUCCESS on success, error code on failure
@@ -175,9 +853,25 @@ ROSIX_Result rosix_stream_set_rate_limit(ROSIX_Stream* stream, int max_rate);
 ROSIX_Result rosix_stream_get_stats(ROSIX_Stream* stream, 
                                      ROSIX_StreamStats* stats);
 
+/**
+ * Get per-operator statistics
+ * 
+ * Operators are reported in the order they were added to the stream.
+ * 
+ * @param stream Stream to get statistics for
+ * @param stats Array to store operator statistics
+ * @param max_operators Maximum number of operators to return
+ * @return Number of operators found on success, -1 on error
+ */
+int rosix_stream_get_operator_stats(ROSIX_Stream* stream,
+                                    ROSIX_StreamOperatorStats* stats,
+                                    size_t max_operators);
+
 /**
  * Reset stream statistics
  * 
+ * Also clears latency histograms and operator statistics.
+ * 
  * @param stream Stream to reset statistics for
  * @return ROSIX_SUCCESS on success, error code on failure
  */
@@ -206,6 +900,20 @@ int rosix_stream_get_buffer_usage(ROSIX_Stream* stream);
 /**
  * Create a stream aggregator
  * 
+ * Each input first reorders its messages by event time and releases them
+ * once its watermark passes them (ties keep arrival order), so every input
+ * reaching the merge is sorted. Inputs are then merged through a loser
+ * tree, so each message costs O(log num_streams) comparisons. Messages
+ * with equal timestamps are emitted in input array order, making the
+ * output deterministic. The merge stalls on an input with no pending
+ * message until that input's watermark passes the head of the tree or its
+ * idle timeout expires. Inputs without event time use arrival time.
+ * 
+ * Messages older than the last timestamp the merge has emitted, such as
+ * data from an idle input that comes back with older timestamps, are late
+ * and handled by the late output of the input they arrived on (see
+ * rosix_stream_set_late_output).
+ * 
  * @param input_streams Array of input streams
  * @param num_streams Number of input streams
  * @param output_stream Output stream for aggregated data
@@ -218,6 +926,9 @@ ROSIX_Result rosix_stream_aggregate(ROSIX_Stream* input_streams[],
 /**
  * Create a stream splitter
  * 
+ * Messages are distributed round-robin across the outputs. Use
+ * rosix_stream_split_routed for content-based routing.
+ * 
  * @param input_stream Input stream to split
  * @param output_streams Array of output streams
  * @param num_streams Number of output streams
@@ -227,15 +938,321 @@ ROSIX_Result rosix_stream_split(ROSIX_Stream* input_stream,
                                 ROSIX_Stream* output_streams[],
                                 size_t num_streams);
 
+/* Routing rule kinds */
+#define ROSIX_ROUTE_PREDICATE  1       /* Field comparison */
+#define ROSIX_ROUTE_KEY_HASH   2       /* Hash of field selects one output of a group */
+#define ROSIX_ROUTE_DEFAULT    3       /* Matches messages no other output took */
+
+/* Routing modes */
+#define ROSIX_ROUTE_FIRST_MATCH 0      /* Deliver to the first matching output */
+#define ROSIX_ROUTE_ALL_MATCHES 1      /* Deliver to every matching output */
+
+/**
+ * Routing rule structure
+ *
+ * Rules naming the same output are combined with AND. Key-hash rules on
+ * the same field form a group; a message matches the output at index
+ * hash(field) % group size within the group.
+ */
+typedef struct {
+    size_t output;                     /* Index into the output stream array */
+    int kind;                          /* Rule kind (ROSIX_ROUTE_*) */
+    const char* field;                 /* Schema field the rule reads */
+    int cmp;                           /* Comparison for predicates (ROSIX_CMP_*) */
+    double number;                     /* Numeric operand */
+    const char* string;                /* String operand, NULL for numeric comparisons */
+} ROSIX_RouteRule;
+
+/**
+ * Create a content-based stream splitter
+ * 
+ * Rules are compiled once into a decision tree over the fields they read,
+ * so each row is routed with one tree walk whose cost does not grow with
+ * the number of outputs. The input must be a typed stream.
+ * 
+ * @param input_stream Input stream to split
+ * @param output_streams Array of output streams
+ * @param num_streams Number of output streams
+ * @param rules Array of routing rules
+ * @param num_rules Number of routing rules
+ * @param mode Routing mode (ROSIX_ROUTE_FIRST_MATCH or ROSIX_ROUTE_ALL_MATCHES)
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_split_routed(ROSIX_Stream* input_stream,
+                                       ROSIX_Stream* output_streams[],
+                                       size_t num_streams,
+                                       const ROSIX_RouteRule rules[],
+                                       size_t num_rules,
+                                       int mode);
+
+/**
+ * Configure event time for a stream
+ * 
+ * The stream watermark trails the largest timestamp seen by
+ * max_out_of_order_ms. Messages are buffered and released in event-time
+ * order as the watermark passes them. A message whose timestamp is already
+ * below the watermark on arrival is late. An input that delivers nothing
+ * for idle_timeout_ms is treated as idle and no longer holds back
+ * downstream merges until it delivers again.
+ * 
+ * @param stream Stream to configure
+ * @param extractor Event-time extractor
+ * @param extractor_context Context for extractor
+ * @param max_out_of_order_ms Maximum expected lateness in milliseconds
+ * @param idle_timeout_ms Idle timeout in milliseconds, 0 to wait forever
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_event_time(ROSIX_Stream* stream,
+                                         ROSIX_StreamTimestampExtractor extractor,
+                                         void* extractor_context,
+                                         int max_out_of_order_ms,
+                                         int idle_timeout_ms);
+
+/**
+ * Set the destination for late messages
+ * 
+ * Late messages are counted in ROSIX_StreamStats.late_messages and
+ * written to late_stream unchanged. Without a late output they are
+ * counted and dropped.
+ * 
+ * @param stream Stream producing late messages
+ * @param late_stream Side output for late messages, NULL to drop them
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_late_output(ROSIX_Stream* stream,
+                                          ROSIX_Stream* late_stream);
+
+/**
+ * Advance the watermark of a stream explicitly
+ * 
+ * Lets a quiet source release downstream merges without sending data.
+ * Watermarks never move backwards.
+ * 
+ * @param stream Stream to advance
+ * @param watermark_ms New watermark in milliseconds since the epoch
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_advance_watermark(ROSIX_Stream* stream,
+                                            int64_t watermark_ms);
+
+/**
+ * Get the current watermark of a stream
+ * 
+ * @param stream Stream to query
+ * @param watermark_ms Output parameter for watermark in milliseconds
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_get_watermark(ROSIX_Stream* stream,
+                                        int64_t* watermark_ms);
+
+/* Resampling interpolation modes */
+#define ROSIX_INTERP_LAST    1         /* Last sample within the grid interval */
+#define ROSIX_INTERP_ZOH     2         /* Most recent sample at or before the grid point */
+#define ROSIX_INTERP_LINEAR  3         /* Linear between the surrounding samples */
+
+/**
+ * Resampler input descriptor
+ */
+typedef struct {
+    ROSIX_Stream* stream;              /* Input stream with event time */
+    ROSIX_StreamValueExtractor value;  /* Value extractor */
+    void* extractor_context;           /* User context for extractor */
+    const char* column;                /* Output column name */
+    int interpolation;                 /* Interpolation mode (ROSIX_INTERP_*) */
+    int max_gap_ms;                    /* Emit null when no sample is this close, 0 for no limit */
+} ROSIX_ResampleInput;
+
+/**
+ * Create a resampler aligning streams on a common clock
+ * 
+ * The output is a typed stream whose schema holds a "timestamp" column
+ * followed by one ROSIX_TYPE_DOUBLE column per input. The row for grid
+ * point t is emitted once every input that is not idle (see the
+ * idle_timeout_ms argument of rosix_stream_set_event_time) has a
+ * watermark past t + max_lookahead_ms. It is also emitted, at the latest,
+ * max_lookahead_ms of processing time after the first input's watermark
+ * passes that point, so a quiet input never stalls the grid. Inputs still
+ * missing a following sample fall back to zero-order hold, or to null if
+ * their last sample is more than max_gap_ms old. Samples arriving for an
+ * already emitted grid point are late. Buffering is therefore bounded by
+ * the input rates times twice max_lookahead_ms.
+ * 
+ * @param inputs Array of resampler inputs
+ * @param num_inputs Number of inputs
+ * @param period_ms Grid period in milliseconds
+ * @param max_lookahead_ms Maximum wait for samples after a grid point
+ * @param output_stream Output stream for aligned rows
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_resample(const ROSIX_ResampleInput inputs[],
+                                   size_t num_inputs,
+                                   int period_ms,
+                                   int max_lookahead_ms,
+                                   ROSIX_Stream* output_stream);
+
 /**
  * Set stream batch size
  * 
+ * Disables adaptive batching if it was enabled.
+ * 
  * @param stream Stream to configure
  * @param batch_size Number of messages per batch
  * @return ROSIX_SUCCESS on success, error code on failure
  */
 ROSIX_Result rosix_stream_set_batch_size(ROSIX_Stream* stream, size_t batch_size);
 
+/**
+ * Adaptive batching configuration structure
+ *
+ * The runtime tracks queue wait and processing time per batch. While the
+ * observed p99 latency is below target_p99_ms it grows the batch size and
+ * linger time to gain throughput; when the target is exceeded it shrinks
+ * them multiplicatively.
+ */
+typedef struct {
+    double target_p99_ms;              /* Target p99 end-to-end latency */
+    size_t min_batch_size;             /* Lower bound on batch size */
+    size_t max_batch_size;             /* Upper bound on batch size */
+    int max_linger_ms;                 /* Upper bound on time a batch waits to fill */
+} ROSIX_StreamAdaptiveBatching;
+
+/**
+ * Enable adaptive batching driven by a latency target
+ * 
+ * @param stream Stream to configure
+ * @param config Adaptive batching configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_adaptive_batching(ROSIX_Stream* stream,
+                                                const ROSIX_StreamAdaptiveBatching* config);
+
+/**
+ * Get the current batch size and linger time
+ * 
+ * @param stream Stream to check
+ * @param batch_size Output parameter for current batch size
+ * @param linger_ms Output parameter for current linger time in milliseconds
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_get_batching(ROSIX_Stream* stream,
+                                       size_t* batch_size,
+                                       double* linger_ms);
+
+/* ============================================================================
+ * Stream Sketches
+ * ============================================================================ */
+
+/* Sketch algorithms */
+#define ROSIX_SKETCH_QUANTILE      1   /* KLL quantile sketch */
+#define ROSIX_SKETCH_DISTINCT      2   /* HyperLogLog distinct count */
+#define ROSIX_SKETCH_HEAVY_HITTERS 3   /* Count-Min sketch with top-k heap */
+
+/* Maximum item key length tracked by heavy-hitter sketches */
+#define ROSIX_SKETCH_MAX_KEY       64
+
+/**
+ * Sketch configuration structure
+ *
+ * Each (window, partition) pair owns one sketch of at most max_bytes,
+ * independent of the number of messages or distinct items seen. Windows
+ * are assigned by event time when the stream has one (see
+ * rosix_stream_set_event_time) and close when the watermark passes their
+ * end; otherwise arrival time is used. Heavy-hitter item keys longer than
+ * ROSIX_SKETCH_MAX_KEY - 1 bytes are truncated, so items sharing that
+ * prefix are counted together; distinct counts hash the full key.
+ */
+typedef struct {
+    int type;                          /* Sketch algorithm (ROSIX_SKETCH_*) */
+    ROSIX_StreamValueExtractor value;  /* Value extractor for quantile sketches */
+    ROSIX_StreamKeyExtractor item;     /* Item extractor for distinct/heavy-hitter sketches */
+    ROSIX_StreamKeyExtractor partition; /* Partition key extractor, NULL for one partition */
+    void* extractor_context;           /* User context for extractors */
+    int window_ms;                     /* Tumbling window length, 0 for unbounded */
+    int retained_windows;              /* Closed windows kept for rolling queries */
+    size_t max_bytes;                  /* Fixed memory budget per sketch */
+    size_t top_k;                      /* Items reported by heavy-hitter sketches */
+} ROSIX_SketchConfig;
+
+/**
+ * Heavy-hitter item estimate
+ */
+typedef struct {
+    char key[ROSIX_SKETCH_MAX_KEY];    /* Item key */
+    uint64_t count;                    /* Estimated occurrence count */
+    uint64_t error;                    /* Upper bound on overestimation */
+} ROSIX_SketchItem;
+
+/**
+ * Add a named sketch operator to the stream
+ * 
+ * If the stream is the output of rosix_stream_aggregate, the sketch is the
+ * first operator on it, and every input carries a sketch with the same
+ * name and configuration, the output sketch is built by merging the input
+ * sketches per window instead of re-reading the messages. Otherwise, for
+ * example when a filter or transform precedes it, the sketch reads the
+ * output messages.
+ * 
+ * @param stream Stream to add sketch to
+ * @param name Sketch name, unique within the stream
+ * @param config Sketch configuration
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_add_sketch(ROSIX_Stream* stream, const char* name,
+                                     const ROSIX_SketchConfig* config);
+
+/**
+ * Remove a named sketch operator from the stream
+ * 
+ * @param stream Stream to remove sketch from
+ * @param name Sketch name
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_remove_sketch(ROSIX_Stream* stream, const char* name);
+
+/**
+ * Query a quantile sketch
+ * 
+ * @param stream Stream owning the sketch
+ * @param name Sketch name
+ * @param partition Partition key, NULL to merge all partitions
+ * @param windows Number of most recent windows to merge (rolling window)
+ * @param quantile Quantile to estimate (0.0 to 1.0, e.g. 0.99)
+ * @param value Output parameter for estimated value
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_sketch_quantile(ROSIX_Stream* stream, const char* name,
+                                          const char* partition, int windows,
+                                          double quantile, double* value);
+
+/**
+ * Query a distinct-count sketch
+ * 
+ * @param stream Stream owning the sketch
+ * @param name Sketch name
+ * @param partition Partition key, NULL to merge all partitions
+ * @param windows Number of most recent windows to merge (rolling window)
+ * @param count Output parameter for estimated distinct count
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_sketch_distinct(ROSIX_Stream* stream, const char* name,
+                                          const char* partition, int windows,
+                                          uint64_t* count);
+
+/**
+ * Query a heavy-hitter sketch
+ * 
+ * @param stream Stream owning the sketch
+ * @param name Sketch name
+ * @param partition Partition key, NULL to merge all partitions
+ * @param windows Number of most recent windows to merge (rolling window)
+ * @param items Array to store items, ordered by descending count
+ * @param max_items Maximum number of items to return
+ * @return Number of items found on success, -1 on error
+ */
+int rosix_stream_sketch_top_k(ROSIX_Stream* stream, const char* name,
+                              const char* partition, int windows,
+                              ROSIX_SketchItem* items, size_t max_items);
+
 /* ============================================================================
  * Stream Persistence and Recovery
  * ============================================================================ */
@@ -258,6 +1275,57 @@ ROSIX_Result rosix_stream_enable_persistence(ROSIX_Stream* stream,
  */
 ROSIX_Result rosix_stream_disable_persistence(ROSIX_Stream* stream);
 
+/**
+ * Persisted stream retention policy structure
+ *
+ * Persisted data is stored in append-only segments. Sealed segments older
+ * than compact_after_seconds are rewritten in the background keeping only
+ * the latest record per compaction key, optionally recompressed at
+ * recompress_level. Segments beyond max_age_seconds or max_bytes are
+ * deleted oldest first. The active segment is never touched.
+ */
+typedef struct {
+    int64_t max_age_seconds;           /* Delete data older than this, 0 for no limit */
+    uint64_t max_bytes;                /* Total size limit, 0 for no limit */
+    ROSIX_StreamKeyExtractor compaction_key; /* Compaction key extractor, NULL to disable */
+    void* extractor_context;           /* User context for extractor */
+    int64_t compact_after_seconds;     /* Minimum segment age before compaction */
+    int recompress_level;              /* Compression level for compacted segments, 0 to keep */
+    uint64_t io_rate_limit;            /* Background I/O limit in bytes/second, 0 for none */
+} ROSIX_StreamRetentionPolicy;
+
+/**
+ * Set retention policy for a persisted stream
+ * 
+ * @param stream Persisted stream
+ * @param policy Retention policy
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_set_retention(ROSIX_Stream* stream,
+                                        const ROSIX_StreamRetentionPolicy* policy);
+
+/**
+ * Start a retention and compaction pass immediately
+ * 
+ * The pass runs in the background under the policy's I/O limit.
+ * 
+ * @param stream Persisted stream
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_compact(ROSIX_Stream* stream);
+
+/**
+ * Get persisted storage usage
+ * 
+ * @param stream Persisted stream
+ * @param bytes Output parameter for bytes on disk
+ * @param segments Output parameter for number of segments
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_get_storage_usage(ROSIX_Stream* stream,
+                                            uint64_t* bytes,
+                                            size_t* segments);
+
 /**
  * Recover stream from persistence
  * 
@@ -268,6 +1336,82 @@ ROSIX_Result rosix_stream_disable_persistence(ROSIX_Stream* stream);
 ROSIX_Result rosix_stream_recover(const char* persistence_path,
                                   ROSIX_Stream* stream);
 
+/* ============================================================================
+ * Stream Benchmarking
+ * ============================================================================ */
+
+/* Synthetic payload shapes */
+#define ROSIX_SYNTH_SCALAR     1       /* One double per message */
+#define ROSIX_SYNTH_RECORD     2       /* Typed record with id, timestamp, value, status */
+#define ROSIX_SYNTH_BLOB       3       /* Opaque bytes of payload_size */
+
+/* Benchmark pipeline stages */
+#define ROSIX_BENCH_FILTER     0x01    /* Threshold filter */
+#define ROSIX_BENCH_WINDOW     0x02    /* Windowed quantile sketch */
+#define ROSIX_BENCH_SPLIT      0x04    /* Key-hash split */
+#define ROSIX_BENCH_PERSIST    0x08    /* Persistence */
+#define ROSIX_BENCH_SINK       0x10    /* ResourceSpace sink */
+
+/**
+ * Synthetic sensor source configuration structure
+ */
+typedef struct {
+    size_t sensors;                    /* Number of simulated sensors */
+    double rate_per_sensor;            /* Messages per second per sensor */
+    int payload_shape;                 /* Payload shape (ROSIX_SYNTH_*) */
+    size_t payload_size;               /* Payload size for blob payloads */
+    double jitter;                     /* Random fraction applied to send intervals */
+    double out_of_order_ratio;         /* Fraction of messages delivered late */
+    int max_delay_ms;                  /* Maximum lateness of late messages */
+    uint64_t seed;                     /* Random seed for reproducible runs */
+} ROSIX_SyntheticSourceConfig;
+
+/**
+ * Benchmark configuration structure
+ */
+typedef struct {
+    ROSIX_SyntheticSourceConfig source; /* Synthetic source */
+    int stages;                        /* Pipeline stages (ROSIX_BENCH_* bitmask) */
+    const char* persistence_path;      /* Directory for ROSIX_BENCH_PERSIST */
+    int warmup_seconds;                /* Warm-up time excluded from the report */
+    int duration_seconds;              /* Measured run time */
+} ROSIX_BenchmarkConfig;
+
+/**
+ * Benchmark report structure
+ */
+typedef struct {
+    uint64_t messages;                 /* Messages processed in the measured run */
+    double messages_per_second;        /* Sustained throughput */
+    ROSIX_LatencySummary latency;      /* End-to-end latency */
+    double cpu_ns_per_message;         /* CPU time per message over all threads */
+    uint64_t peak_memory_bytes;        /* Resident memory high-water mark */
+    uint64_t messages_dropped;         /* Messages shed or lost */
+} ROSIX_BenchmarkReport;
+
+/**
+ * Open a stream fed by a synthetic sensor source
+ * 
+ * @param config Synthetic source configuration
+ * @param stream Stream configuration structure
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_open_synthetic(const ROSIX_SyntheticSourceConfig* config,
+                                         ROSIX_Stream* stream);
+
+/**
+ * Run a stream benchmark
+ * 
+ * Builds the selected pipeline over a synthetic source, runs it for the
+ * configured time and reports the measured run.
+ * 
+ * @param config Benchmark configuration
+ * @param report Output parameter for benchmark report
+ * @return ROSIX_SUCCESS on success, error code on failure
+ */
+ROSIX_Result rosix_stream_benchmark(const ROSIX_BenchmarkConfig* config,
+                                    ROSIX_BenchmarkReport* report);
+
 #ifdef __cplusplus
 }
 #endif